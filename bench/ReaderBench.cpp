@@ -0,0 +1,66 @@
+// Per-tick cost of the /proc readers: the persistent pread path used by the
+// samplers vs. the previous open-an-ifstream-every-tick path.
+// Build with -DOTUS_BUILD_BENCH=ON, run ./otus_bench [iterations]
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "otus/CpuSampler.hpp"
+#include "otus/MemSampler.hpp"
+
+namespace {
+
+    // Previous implementations, kept verbatim for comparison
+    otus::CpuTimes legacy_cpu() {
+        std::ifstream f("/proc/stat");
+        otus::CpuTimes c{}; std::string tag;
+        if (f && (f>>tag) && tag=="cpu")
+            f >> c.user >> c.nice >> c.system >> c.idle >> c.iowait >> c.irq >> c.softirq >> c.steal;
+        return c;
+    }
+
+    otus::MemInfo legacy_mem() {
+        std::ifstream f("/proc/meminfo");
+        otus::MemInfo m{}; std::string key, unit; uint64_t val=0;
+        while (f >> key >> val >> unit) {
+            if (key=="MemTotal:") m.memTotalKiB = val;
+            else if (key=="MemAvailable:") m.memAvailKiB = val;
+            else if (key=="SwapTotal:") m.swapTotalKiB = val;
+            else if (key=="SwapFree:") m.swapFreeKiB = val;
+        }
+        return m;
+    }
+
+    volatile uint64_t g_sink = 0;
+
+    template <typename F>
+    void run(const char* name, int iters, F&& fn) {
+        for (int i = 0; i < iters/10; i++) fn(); // warm up
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < iters; i++) fn();
+        auto t1 = std::chrono::steady_clock::now();
+        double us = std::chrono::duration<double, std::micro>(t1 - t0).count() / iters;
+        std::cout << "  " << name << std::string(28 - std::string(name).size(), ' ')
+                  << us << " us/tick\n";
+    }
+
+}
+
+int main(int argc, char** argv) {
+    int iters = argc > 1 ? std::atoi(argv[1]) : 20000;
+    if (iters <= 0) iters = 20000;
+
+    otus::CpuSampler cpu;
+    otus::MemSampler mem;
+
+    std::cout << "otus reader bench (" << iters << " iterations)\n";
+    run("cpu   ifstream",          iters, [&]{ g_sink += legacy_cpu().total(); });
+    run("cpu   pread",             iters, [&]{ g_sink += (uint64_t)cpu.sample(); });
+    run("mem   ifstream (4 keys)", iters, [&]{ g_sink += legacy_mem().memAvailKiB; });
+    run("mem   pread (19 keys)",   iters, [&]{ g_sink += mem.sample().memAvailKiB; });
+    run("vmstat pread (10 keys)",  iters, [&]{ g_sink += (uint64_t)mem.vm_rates(1.0).faultsPerSec; });
+    return 0;
+}
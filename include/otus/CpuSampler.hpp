@@ -1,5 +1,6 @@
 #pragma once
 #include "Types.hpp"
+#include "ProcFile.hpp"
 
 namespace otus {
 
@@ -9,7 +10,8 @@ namespace otus {
     private:
         CpuTimes prev_{};
         bool hasPrev_ = false;
-        static CpuTimes read_now();
+        ProcFile stat_{"/proc/stat"};
+        CpuTimes read_now();
     };
 
 }
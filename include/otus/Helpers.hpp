@@ -22,11 +22,15 @@ namespace otus {
         try { return std::stoull(s); } catch (...) { return 0ULL; }
     }
 
-    inline bool read_sysfs_u64_trim(const std::string& path, uint64_t& out) {
-        std::string s; if (!read_all(path, s)) return false;
+    inline std::string trim(const std::string& s) {
         size_t i=0; while (i<s.size() && std::isspace((unsigned char)s[i])) ++i;
         size_t j=s.size(); while (j>i && std::isspace((unsigned char)s[j-1])) --j;
-        out = to_u64(s.substr(i, j-i));
+        return s.substr(i, j-i);
+    }
+
+    inline bool read_sysfs_u64_trim(const std::string& path, uint64_t& out) {
+        std::string s; if (!read_all(path, s)) return false;
+        out = to_u64(trim(s));
         return true;
     }
 
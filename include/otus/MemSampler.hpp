@@ -1,11 +1,18 @@
 #pragma once
 #include "Types.hpp"
+#include "ProcFile.hpp"
 
 namespace otus {
 
     class MemSampler {
     public:
-        MemInfo sample() const;
+        MemInfo sample();
+        VmRates vm_rates(double dtSeconds); // per-second deltas of /proc/vmstat
+    private:
+        ProcFile meminfo_{"/proc/meminfo"};
+        ProcFile vmstat_{"/proc/vmstat"};
+        VmStat prevVm_{};
+        bool hasPrevVm_ = false;
     };
 
 }
@@ -0,0 +1,105 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace otus {
+
+    // Pseudo-file (/proc, /sys) kept open across ticks. Every read() is a pread
+    // from offset 0 into a buffer that is reused, so a tick costs no open/close
+    // and no allocation once the buffer has grown to fit the file.
+    class ProcFile {
+    public:
+        explicit ProcFile(std::string path);
+        ~ProcFile();
+        ProcFile(ProcFile&& o) noexcept;
+        ProcFile& operator=(ProcFile&& o) noexcept;
+        ProcFile(const ProcFile&) = delete;
+        ProcFile& operator=(const ProcFile&) = delete;
+
+        bool read(std::string_view& out); // view is valid until the next read()
+        bool read_u64(uint64_t& out);     // single-value sysfs attribute, no buffer
+        bool read_i64(int64_t& out);      // same, for signed values (hwmon millidegrees)
+        bool is_open() const { return fd_ >= 0; }
+        const std::string& path() const { return path_; }
+
+    private:
+        std::string path_;
+        std::string buf_;
+        int fd_ = -1;
+        bool open();
+    };
+
+    // Skips leading blanks and parses an unsigned decimal, advancing p
+    inline uint64_t parse_u64(const char*& p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\t')) ++p;
+        uint64_t v = 0;
+        while (p < end && (unsigned)(*p - '0') < 10u) v = v*10 + (uint64_t)(*p++ - '0');
+        return v;
+    }
+
+    // Seeded FNV-1a, usable in constant expressions. The high half is folded
+    // in because FNV's low bits only ever see the low bits of each byte.
+    constexpr uint32_t key_hash(std::string_view s, uint32_t seed) {
+        uint32_t h = 2166136261u ^ seed;
+        for (char c : s) { h ^= (unsigned char)c; h *= 16777619u; }
+        return h ^ (h >> 16);
+    }
+
+    template <typename T>
+    struct KeyField {
+        std::string_view key;
+        uint64_t T::* field = nullptr;
+    };
+
+    // Compile-time key → member table. Keys are placed by hash into Slots
+    // buckets; perfect() lets callers static_assert that no two keys share a
+    // bucket (pick another Seed if they do), so a lookup is one hash, one
+    // index and one compare.
+    template <typename T, size_t N, size_t Slots, uint32_t Seed = 0>
+    class KeyTable {
+        static_assert((Slots & (Slots-1)) == 0, "Slots must be a power of two");
+    public:
+        constexpr explicit KeyTable(const std::array<KeyField<T>, N>& fields) : fields_(fields) {
+            for (size_t i = 0; i < N; ++i) slots_[key_hash(fields[i].key, Seed) & (Slots-1)] = fields[i];
+        }
+
+        constexpr bool perfect() const {
+            for (size_t i = 0; i < N; ++i)
+                if (slots_[key_hash(fields_[i].key, Seed) & (Slots-1)].key != fields_[i].key) return false;
+            return true;
+        }
+
+        uint64_t T::* find(std::string_view key) const {
+            const auto& s = slots_[key_hash(key, Seed) & (Slots-1)];
+            return s.key == key ? s.field : nullptr;
+        }
+
+    private:
+        std::array<KeyField<T>, N> fields_{};
+        std::array<KeyField<T>, Slots> slots_{};
+    };
+
+    // Parses "key<sep> value ..." lines (meminfo uses ':', vmstat uses ' ')
+    // and stores the value of every key the table knows about.
+    template <typename T, size_t N, size_t Slots, uint32_t Seed>
+    void parse_kv(std::string_view buf, char sep, const KeyTable<T, N, Slots, Seed>& table, T& out) {
+        const char* p = buf.data();
+        const char* end = p + buf.size();
+        while (p < end) {
+            const char* k = p;
+            while (p < end && *p != sep && *p != '\n') ++p;
+            if (p < end && *p == sep) {
+                std::string_view key(k, (size_t)(p - k));
+                ++p;
+                uint64_t v = parse_u64(p, end);
+                if (auto f = table.find(key)) out.*f = v;
+            }
+            while (p < end && *p != '\n') ++p;
+            if (p < end) ++p;
+        }
+    }
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Types.hpp"
+#include "ProcFile.hpp"
+
+namespace otus {
+
+    class SensorSampler {
+    public:
+        explicit SensorSampler(const std::string& sysRoot = "/sys"); // discovery runs once, here
+        SensorInfo sample();
+    private:
+        struct Temp { std::string label; bool package; ProcFile file; };
+        std::vector<ProcFile> freqs_;   // cpuN/cpufreq/scaling_cur_freq, ordered by N
+        std::vector<Temp> temps_;       // tempN_input of CPU hwmon chips
+
+        void discover_freq(const std::string& sysRoot);
+        void discover_hwmon(const std::string& sysRoot);
+    };
+
+}
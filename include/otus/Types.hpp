@@ -1,5 +1,7 @@
 #pragma once
+#include <algorithm>
 #include <cstdint>
+#include <deque>
 #include <string>
 #include <vector>
 
@@ -12,8 +14,51 @@ namespace otus {
     };
 
     struct MemInfo {
-        uint64_t memTotalKiB=0, memAvailKiB=0;
+        uint64_t memTotalKiB=0, memFreeKiB=0, memAvailKiB=0;
+        uint64_t buffersKiB=0, cachedKiB=0, swapCachedKiB=0;
+        uint64_t activeKiB=0, inactiveKiB=0;
+        uint64_t dirtyKiB=0, writebackKiB=0;
+        uint64_t shmemKiB=0, slabKiB=0, sReclaimableKiB=0, sUnreclaimKiB=0;
         uint64_t swapTotalKiB=0, swapFreeKiB=0;
+        uint64_t hugePagesTotal=0, hugePagesFree=0, hugePageSizeKiB=0;
+    };
+
+    // Raw /proc/vmstat counters (pages or events since boot)
+    struct VmStat {
+        uint64_t pgfault=0, pgmajfault=0;
+        uint64_t pswpin=0, pswpout=0;
+        uint64_t pgstealKswapd=0, pgstealDirect=0, pgstealKhugepaged=0;
+        uint64_t pgscanKswapd=0, pgscanDirect=0, pgscanKhugepaged=0;
+        uint64_t reclaimed() const { return pgstealKswapd+pgstealDirect+pgstealKhugepaged; }
+        uint64_t scanned()   const { return pgscanKswapd+pgscanDirect+pgscanKhugepaged; }
+    };
+
+    struct VmRates {
+        double faultsPerSec=0.0, majFaultsPerSec=0.0;
+        double swapInPerSec=0.0, swapOutPerSec=0.0;   // pages/s
+        double reclaimPerSec=0.0, scanPerSec=0.0;     // pages/s
+    };
+
+    struct TempReading {
+        std::string label;    // hwmon tempN_label, or "<chip> tempN"
+        double celsius=0.0;
+    };
+
+    struct SensorInfo {
+        std::vector<double> coreMHz;   // per online CPU with cpufreq, 0 if unreadable
+        size_t freqCount=0;            // entries of coreMHz that were actually read
+        double avgMHz=0.0, minMHz=0.0, maxMHz=0.0;  // over readable cores only
+        std::vector<TempReading> temps;
+        double packageC=0.0;           // hottest package/Tdie/Tctl sensor, else hottest sensor
+    };
+
+    // Last `cap` samples of one metric, oldest first
+    struct MetricHistory {
+        size_t cap=60;
+        std::deque<double> values;
+        void push(double v) { values.push_back(v); if (values.size() > cap) values.pop_front(); }
+        double min() const { return values.empty() ? 0.0 : *std::min_element(values.begin(), values.end()); }
+        double max() const { return values.empty() ? 0.0 : *std::max_element(values.begin(), values.end()); }
     };
 
     struct DiskUsage {
@@ -1,17 +1,19 @@
-#include <fstream>
-#include <string>
+#include <string_view>
 #include "otus/CpuSampler.hpp"
 
 namespace otus {
 
     CpuTimes CpuSampler::read_now() {
-        std::ifstream f("/proc/stat"); // Poll CPU stats from a quick syscall to VFS
-        CpuTimes c{}; std::string tag;
-        if (f && (f>>tag) && tag=="cpu")
-            f >> c.user >> c.nice >> c.system >> c.idle >> c.iowait >> c.irq >> c.softirq >> c.steal;
+        CpuTimes c{}; std::string_view buf;
+        if (!stat_.read(buf) || buf.compare(0, 4, "cpu ") != 0) return c;
+        const char* p = buf.data() + 4; // aggregate "cpu" line always comes first
+        const char* end = buf.data() + buf.size();
+        for (uint64_t CpuTimes::* f : {&CpuTimes::user, &CpuTimes::nice, &CpuTimes::system, &CpuTimes::idle,
+                                       &CpuTimes::iowait, &CpuTimes::irq, &CpuTimes::softirq, &CpuTimes::steal})
+            c.*f = parse_u64(p, end);
         return c;
 
-        // TODO: Add sysfs frequency and per core usage later on
+        // TODO: Add per core usage later on
     }
 
     double CpuSampler::sample() {
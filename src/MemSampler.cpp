@@ -1,18 +1,73 @@
-#include <fstream>
-#include <string>
 #include "otus/MemSampler.hpp"
 
 namespace otus {
 
-    MemInfo MemSampler::sample() const {
-        std::ifstream f("/proc/meminfo");
-        MemInfo m{}; std::string key, unit; uint64_t val=0;
-        while (f >> key >> val >> unit) {
-            if (key=="MemTotal:") m.memTotalKiB = val;
-            else if (key=="MemAvailable:") m.memAvailKiB = val;
-            else if (key=="SwapTotal:") m.swapTotalKiB = val;
-            else if (key=="SwapFree:") m.swapFreeKiB = val;
+    namespace {
+
+        constexpr KeyTable<MemInfo, 19, 32, 13> kMemKeys({{
+            {"MemTotal",        &MemInfo::memTotalKiB},
+            {"MemFree",         &MemInfo::memFreeKiB},
+            {"MemAvailable",    &MemInfo::memAvailKiB},
+            {"Buffers",         &MemInfo::buffersKiB},
+            {"Cached",          &MemInfo::cachedKiB},
+            {"SwapCached",      &MemInfo::swapCachedKiB},
+            {"Active",          &MemInfo::activeKiB},
+            {"Inactive",        &MemInfo::inactiveKiB},
+            {"Dirty",           &MemInfo::dirtyKiB},
+            {"Writeback",       &MemInfo::writebackKiB},
+            {"Shmem",           &MemInfo::shmemKiB},
+            {"Slab",            &MemInfo::slabKiB},
+            {"SReclaimable",    &MemInfo::sReclaimableKiB},
+            {"SUnreclaim",      &MemInfo::sUnreclaimKiB},
+            {"SwapTotal",       &MemInfo::swapTotalKiB},
+            {"SwapFree",        &MemInfo::swapFreeKiB},
+            {"HugePages_Total", &MemInfo::hugePagesTotal},
+            {"HugePages_Free",  &MemInfo::hugePagesFree},
+            {"Hugepagesize",    &MemInfo::hugePageSizeKiB},
+        }});
+        static_assert(kMemKeys.perfect(), "meminfo key table has a hash collision, change Seed");
+
+        constexpr KeyTable<VmStat, 10, 16, 18> kVmKeys({{
+            {"pgfault",            &VmStat::pgfault},
+            {"pgmajfault",         &VmStat::pgmajfault},
+            {"pswpin",             &VmStat::pswpin},
+            {"pswpout",            &VmStat::pswpout},
+            {"pgsteal_kswapd",     &VmStat::pgstealKswapd},
+            {"pgsteal_direct",     &VmStat::pgstealDirect},
+            {"pgsteal_khugepaged", &VmStat::pgstealKhugepaged},
+            {"pgscan_kswapd",      &VmStat::pgscanKswapd},
+            {"pgscan_direct",      &VmStat::pgscanDirect},
+            {"pgscan_khugepaged",  &VmStat::pgscanKhugepaged},
+        }});
+        static_assert(kVmKeys.perfect(), "vmstat key table has a hash collision, change Seed");
+
+        double rate(uint64_t cur, uint64_t prev, double dt) {
+            return cur >= prev ? (double)(cur - prev) / dt : 0.0;
         }
+
+    }
+
+    MemInfo MemSampler::sample() {
+        MemInfo m{}; std::string_view buf;
+        if (meminfo_.read(buf)) parse_kv(buf, ':', kMemKeys, m);
         return m;
     }
+
+    VmRates MemSampler::vm_rates(double dtSeconds) {
+        VmStat cur{}; std::string_view buf;
+        if (!vmstat_.read(buf)) return VmRates{};
+        parse_kv(buf, ' ', kVmKeys, cur);
+
+        VmRates r{};
+        if (hasPrevVm_ && dtSeconds > 0.0) {
+            r.faultsPerSec    = rate(cur.pgfault,     prevVm_.pgfault,     dtSeconds);
+            r.majFaultsPerSec = rate(cur.pgmajfault,  prevVm_.pgmajfault,  dtSeconds);
+            r.swapInPerSec    = rate(cur.pswpin,      prevVm_.pswpin,      dtSeconds);
+            r.swapOutPerSec   = rate(cur.pswpout,     prevVm_.pswpout,     dtSeconds);
+            r.reclaimPerSec   = rate(cur.reclaimed(), prevVm_.reclaimed(), dtSeconds);
+            r.scanPerSec      = rate(cur.scanned(),   prevVm_.scanned(),   dtSeconds);
+        }
+        prevVm_ = cur; hasPrevVm_ = true;
+        return r;
+    }
 }
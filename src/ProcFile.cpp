@@ -0,0 +1,74 @@
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <utility>
+#include "otus/ProcFile.hpp"
+
+namespace otus {
+
+    ProcFile::ProcFile(std::string path) : path_(std::move(path)) {
+        open();
+    }
+
+    ProcFile::~ProcFile() {
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    ProcFile::ProcFile(ProcFile&& o) noexcept
+        : path_(std::move(o.path_)), buf_(std::move(o.buf_)), fd_(o.fd_) {
+        o.fd_ = -1;
+    }
+
+    ProcFile& ProcFile::operator=(ProcFile&& o) noexcept {
+        if (this != &o) {
+            if (fd_ >= 0) ::close(fd_);
+            path_ = std::move(o.path_); buf_ = std::move(o.buf_);
+            fd_ = o.fd_; o.fd_ = -1;
+        }
+        return *this;
+    }
+
+    bool ProcFile::open() {
+        fd_ = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+        return fd_ >= 0;
+    }
+
+    bool ProcFile::read(std::string_view& out) {
+        if (fd_ < 0 && !open()) return false;
+        if (buf_.empty()) buf_.resize(4096); // lazily, read_u64-only files never need one
+        size_t len = 0;
+        for (;;) {
+            if (len == buf_.size()) buf_.resize(buf_.size() * 2); // grows until the file fits, then is reused
+            ssize_t n = ::pread(fd_, &buf_[len], buf_.size() - len, (off_t)len);
+            if (n < 0) { if (errno == EINTR) continue; return false; }
+            if (n == 0) break;
+            len += (size_t)n;
+        }
+        out = std::string_view(buf_.data(), len);
+        return true;
+    }
+
+    bool ProcFile::read_u64(uint64_t& out) {
+        int64_t v = 0;
+        if (!read_i64(v) || v < 0) return false;
+        out = (uint64_t)v;
+        return true;
+    }
+
+    bool ProcFile::read_i64(int64_t& out) {
+        if (fd_ < 0 && !open()) return false;
+        char b[32];
+        ssize_t n;
+        do n = ::pread(fd_, b, sizeof b, 0); while (n < 0 && errno == EINTR);
+        if (n <= 0) return false;
+        const char* p = b;
+        bool neg = (*p == '-');
+        if (neg) ++p;
+        const char* digits = p;
+        uint64_t v = parse_u64(p, b + n);
+        if (p == digits) return false;
+        out = neg ? -(int64_t)v : (int64_t)v;
+        return true;
+    }
+
+}
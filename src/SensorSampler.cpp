@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+#include "otus/SensorSampler.hpp"
+#include "otus/Helpers.hpp"
+
+namespace fs = std::filesystem;
+
+namespace otus {
+
+namespace {
+
+    // "cpu12" → 12, "temp3_input" (prefix "temp") → 3, anything else → -1
+    int index_after(const std::string& name, const std::string& prefix) {
+        if (name.compare(0, prefix.size(), prefix) != 0 || name.size() == prefix.size()) return -1;
+        int n = 0; size_t i = prefix.size();
+        for (; i < name.size() && std::isdigit((unsigned char)name[i]); ++i) n = n*10 + (name[i]-'0');
+        return i == prefix.size() ? -1 : n;
+    }
+
+    // hwmon drivers that report CPU die/package temperatures
+    bool is_cpu_chip(const std::string& name) {
+        return name == "coretemp" || name == "k10temp" || name == "zenpower"
+            || name.find("cpu") != std::string::npos || name.find("soc") != std::string::npos;
+    }
+
+    // Package id N (coretemp) and Tdie (k10temp) are the real package/die
+    // temperature. Zen/Zen+ report Tctl as Tdie plus a fixed 10-27°C fan
+    // control offset, so Tctl only counts when the chip has no Tdie.
+    bool is_package_label(const std::string& label) {
+        return label.compare(0, 7, "Package") == 0 || label == "Tdie";
+    }
+
+}
+
+SensorSampler::SensorSampler(const std::string& sysRoot) {
+    discover_freq(sysRoot);
+    discover_hwmon(sysRoot);
+}
+
+void SensorSampler::discover_freq(const std::string& sysRoot) {
+    std::error_code ec;
+    std::vector<std::pair<int, std::string>> cpus;
+    for (auto& e : fs::directory_iterator(sysRoot + "/devices/system/cpu", ec)) {
+        int n = index_after(e.path().filename().string(), "cpu");
+        if (n < 0) continue;
+        auto f = e.path() / "cpufreq" / "scaling_cur_freq";
+        if (fs::exists(f, ec)) cpus.emplace_back(n, f.string()); // offline CPUs have no cpufreq dir
+    }
+    std::sort(cpus.begin(), cpus.end());
+    for (auto& c : cpus) freqs_.emplace_back(std::move(c.second));
+}
+
+void SensorSampler::discover_hwmon(const std::string& sysRoot) {
+    std::error_code ec;
+    std::vector<fs::path> chips;
+    for (auto& e : fs::directory_iterator(sysRoot + "/class/hwmon", ec)) chips.push_back(e.path());
+    std::sort(chips.begin(), chips.end());
+
+    for (auto& chip : chips) {
+        std::string name;
+        if (!read_all((chip / "name").string(), name)) continue;
+        name = trim(name);
+        if (!is_cpu_chip(name)) continue;
+
+        std::vector<std::pair<int, fs::path>> inputs;
+        for (auto& e : fs::directory_iterator(chip, ec)) {
+            auto fn = e.path().filename().string();
+            int n = index_after(fn, "temp");
+            if (n >= 0 && fn == "temp" + std::to_string(n) + "_input") inputs.emplace_back(n, e.path());
+        }
+        std::sort(inputs.begin(), inputs.end());
+
+        size_t first = temps_.size();
+        bool chipHasPkg = false;
+        for (auto& in : inputs) {
+            std::string label;
+            if (read_all((chip / ("temp" + std::to_string(in.first) + "_label")).string(), label))
+                label = trim(label);
+            if (label.empty()) label = name + " temp" + std::to_string(in.first);
+            bool pkg = is_package_label(label);
+            chipHasPkg |= pkg;
+            temps_.push_back(Temp{std::move(label), pkg, ProcFile(in.second.string())});
+        }
+        if (!chipHasPkg)
+            for (size_t i = first; i < temps_.size(); ++i)
+                temps_[i].package = (temps_[i].label == "Tctl");
+    }
+}
+
+SensorInfo SensorSampler::sample() {
+    SensorInfo s{};
+
+    s.coreMHz.resize(freqs_.size());
+    double sum = 0.0; size_t ok = 0;
+    for (size_t i = 0; i < freqs_.size(); ++i) {
+        uint64_t khz = 0;
+        if (!freqs_[i].read_u64(khz)) continue;
+        double mhz = khz / 1000.0;
+        s.coreMHz[i] = mhz;
+        sum += mhz;
+        s.minMHz = ok ? std::min(s.minMHz, mhz) : mhz;
+        s.maxMHz = std::max(s.maxMHz, mhz);
+        ++ok;
+    }
+    s.freqCount = ok;
+    if (ok) s.avgMHz = sum / ok;
+
+    double pkg = 0.0, hottest = 0.0; bool havePkg = false, haveAny = false;
+    s.temps.reserve(temps_.size());
+    for (auto& t : temps_) {
+        int64_t milli = 0;
+        if (!t.file.read_i64(milli)) continue;
+        double c = milli / 1000.0;
+        s.temps.push_back(TempReading{t.label, c});
+        hottest = haveAny ? std::max(hottest, c) : c; haveAny = true;
+        if (t.package) { pkg = havePkg ? std::max(pkg, c) : c; havePkg = true; }
+    }
+    s.packageC = havePkg ? pkg : hottest;
+    return s;
+}
+
+}
@@ -17,6 +17,7 @@
 #include "otus/DiskSampler.hpp"
 #include "otus/GpuSampler.hpp"
 #include "otus/ProcSampler.hpp"
+#include "otus/SensorSampler.hpp"
 
 using namespace ftxui;
 using std::string;
@@ -68,6 +69,7 @@ struct Options {
     bool cpu=false, gpu=false, mem=false, proc=false;
     int procLimit=40;
     int intervalSec=1;
+    string sysRoot="/sys";
 };
 
 void print_help(const char* prog) {
@@ -81,6 +83,7 @@ void print_help(const char* prog) {
 "  " << prog << " -proc       process tree only\n"
 "  " << prog << " -proc -lim N  limit process nodes (default 40)\n"
 "  " << prog << " -i SEC      refresh interval (default 1)\n"
+"  " << prog << " -sys DIR    sysfs root for cpufreq/hwmon (default /sys)\n"
 "  " << prog << " --help\n\n"
 "Press q / ESC / Ctrl-C to quit.\n";
 }
@@ -106,6 +109,7 @@ Options parse_args(int argc, char** argv) {
             if (*end || v <= 0) { std::cerr << "Invalid -i value\n"; std::exit(2); }
             o.intervalSec = (int)v;
         }
+        else if (a == "-sys" && i+1 < argc) o.sysRoot = argv[++i];
     }
     return o;
 }
@@ -267,11 +271,17 @@ int main(int argc, char** argv) {
     }
 
     //dashboard
+    otus::SensorSampler sensors(opt.sysRoot); // cpufreq/hwmon discovery, once
+    otus::MetricHistory freqHist, tempHist;
     while (g_run) {
         double c = cpu.sample();
         auto m = mem.sample();
+        auto vm = mem.vm_rates(opt.intervalSec);
         auto d = disk.sample("/");
         auto g = gpu.sample();
+        auto sn = sensors.sample();
+        if (sn.freqCount)        freqHist.push(sn.avgMHz);
+        if (!sn.temps.empty())   tempHist.push(sn.packageC);
 
         double mem_ratio  = m.memTotalKiB ? (double)(m.memTotalKiB - m.memAvailKiB) / m.memTotalKiB : 0.0;
         double disk_ratio = d.totalBytes  ? (double)d.usedBytes / d.totalBytes : 0.0;
@@ -292,6 +302,27 @@ int main(int argc, char** argv) {
                     fmt1((m.memTotalKiB-m.memAvailKiB)/1048576.0) + "/" + fmt1(m.memTotalKiB/1048576.0) + " GiB"),
                 gauge_labeled("DSK  ", disk_ratio,
                     gib_bytes(d.usedBytes) + "/" + gib_bytes(d.totalBytes)),
+                hbox({
+                    text("VM   ") | dim,
+                    text("cache " + fmt1(m.cachedKiB/1048576.0) + "G  dirty " + fmt1(m.dirtyKiB/1024.0)
+                        + "M  slab " + fmt1(m.slabKiB/1024.0) + "M"),
+                    filler(),
+                    text("flt " + std::to_string((long)vm.faultsPerSec) + "/s  maj "
+                        + std::to_string((long)vm.majFaultsPerSec) + "/s  swp "
+                        + std::to_string((long)vm.swapInPerSec) + "/" + std::to_string((long)vm.swapOutPerSec)
+                        + "  rcl " + std::to_string((long)vm.reclaimPerSec) + "/s") | dim,
+                }),
+                hbox({
+                    text("FRQ  ") | dim,
+                    text(!sn.freqCount
+                        ? "N/A"
+                        : fmt1(sn.avgMHz/1000.0) + " GHz  (" + fmt1(sn.minMHz/1000.0) + "-" + fmt1(sn.maxMHz/1000.0)
+                            + ", low avg " + fmt1(freqHist.min()/1000.0) + ")  x" + std::to_string(sn.freqCount)),
+                    filler(),
+                    text(sn.temps.empty()
+                        ? "no CPU temperature sensor"
+                        : "PKG " + fmt1(sn.packageC) + "°C  peak " + fmt1(tempHist.max()) + "°C") | dim,
+                }),
                 separator(),
                 hbox({
                     text("GPU  ") | dim,